@@ -183,4 +183,54 @@ int writeImage(char* destFileName, void* sharedVoid) {
 
     fclose(out);
     return 0;
-}
\ No newline at end of file
+}
+
+// Reduce la imagen por un factor entero promediando bloques de factor x factor pixeles.
+// Los bloques del borde derecho/inferior que quedan incompletos se promedian con los pixeles disponibles.
+int downsampleImage(void* srcVoid, void* destVoid, int factor) {
+    SharedData* src  = (SharedData*)srcVoid;
+    SharedData* dest = (SharedData*)destVoid;
+    if (factor < 1) {
+        printError(ARGUMENT_ERROR);
+        return -1;
+    }
+
+    int width  = src->header.width_px;
+    int height = src->header.height_px;
+    // Redondeo hacia arriba sin sumar, para no desbordar con factores grandes
+    int dw = width  / factor + (width  % factor != 0);
+    int dh = height / factor + (height % factor != 0);
+
+    for (int y = 0; y < dh; y++) {
+        int y0 = y * factor;
+        int y1 = (y0 + factor < height) ? y0 + factor : height;
+        for (int x = 0; x < dw; x++) {
+            int x0 = x * factor;
+            int x1 = (x0 + factor < width) ? x0 + factor : width;
+            int sumB=0, sumG=0, sumR=0, sumA=0;
+            for (int sy = y0; sy < y1; sy++) {
+                for (int sx = x0; sx < x1; sx++) {
+                    sumB += src->pixels[sy][sx].blue;
+                    sumG += src->pixels[sy][sx].green;
+                    sumR += src->pixels[sy][sx].red;
+                    sumA += src->pixels[sy][sx].alpha;
+                }
+            }
+            int n = (y1 - y0) * (x1 - x0);
+            dest->pixels[y][x].blue  = sumB / n;
+            dest->pixels[y][x].green = sumG / n;
+            dest->pixels[y][x].red   = sumR / n;
+            dest->pixels[y][x].alpha = sumA / n;
+        }
+    }
+
+    // Encabezado con las nuevas dimensiones
+    int bytesPerPixel = src->header.bits_per_pixel / 8;
+    int rowSize = (dw * bytesPerPixel + 3) & ~3;
+    dest->header = src->header;
+    dest->header.width_px  = dw;
+    dest->header.height_px = dh;
+    dest->header.imagesize = rowSize * dh;
+    dest->header.size      = dest->header.offset + dest->header.imagesize;
+    return 0;
+}
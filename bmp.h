@@ -41,5 +41,6 @@ void printError(int error);
 int checkBMPValid(BMP_Header* header);
 int readImage(FILE *srcFile, void* sharedVoid);
 int writeImage(char* destFileName, void* sharedVoid);
+int downsampleImage(void* srcVoid, void* destVoid, int factor);
 
 #endif 
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "common.h"
 #include "bmp.h"
+#include "filtros.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -16,26 +17,6 @@ typedef struct {
     int endY;
 } DesenfoqueTask;
 
-// Función que desenfoca filas [startY..endY) en la mitad superior
-static void blur_chunk(SharedData* shared, int startY, int endY) {
-    int width  = shared->header.width_px;
-    for (int y = startY; y < endY - 1; y++) {
-        for (int x = 1; x < width - 1; x++) {
-            int sumB=0, sumG=0, sumR=0;
-            for (int dy=-1; dy<=1; dy++) {
-                for (int dx=-1; dx<=1; dx++) {
-                    sumB += shared->pixels[y+dy][x+dx].blue;
-                    sumG += shared->pixels[y+dy][x+dx].green;
-                    sumR += shared->pixels[y+dy][x+dx].red;
-                }
-            }
-            shared->pixels[y][x].blue  = sumB/9;
-            shared->pixels[y][x].green = sumG/9;
-            shared->pixels[y][x].red   = sumR/9;
-        }
-    }
-}
-
 // Hilo que procesa un chunk de desenfoque
 static void* blur_thread(void* arg) {
     DesenfoqueTask* task = (DesenfoqueTask*)arg;
@@ -100,7 +81,7 @@ int main(int argc, char* argv[]) {
 
         for (int i = 0; i < numThreads; i++) {
             tasks[i].shared = shared;
-            tasks[i].startY = i * chunk;
+            tasks[i].startY = (i == 0) ? 1 : i * chunk;
             tasks[i].endY   = (i == numThreads - 1) ? half : (i + 1) * chunk;
             pthread_create(&threads[i], NULL, blur_thread, &tasks[i]);
         }
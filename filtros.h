@@ -0,0 +1,10 @@
+#ifndef FILTROS_H
+#define FILTROS_H
+
+#include "common.h"
+
+// Kernels compartidos por el Desenfocador, el Realzador y la vista previa del Publicador.
+void blur_chunk(SharedData* shared, int startY, int endY);
+void realce_chunk(SharedData* shared, int startY, int endY);
+
+#endif
@@ -1,6 +1,7 @@
 #define _POSIX_C_SOURCE 200809L
 #include "common.h"
 #include "bmp.h"
+#include "filtros.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <fcntl.h>
@@ -54,12 +55,59 @@ static int wait_with_timeout(sem_t* sem, const char* name, int seconds) {
     return 1;
 }
 
-int main() {
+// Aplica ambos filtros sobre la copia reducida (desenfoque arriba, realce abajo) y la guarda en disco.
+// t0 es el instante previo a downsampleImage, para que el tiempo reportado incluya la reducción.
+static void write_preview(SharedData* preview, char* pathPreview, struct timespec t0) {
+    struct timespec t1;
+
+    int height = preview->header.height_px;
+    int half   = height / 2;
+    blur_chunk(preview, 1, half);
+    realce_chunk(preview, half, height);
+
+    if (writeImage(pathPreview, preview) == -1) {
+        return;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double ms = (t1.tv_sec - t0.tv_sec) * 1000.0 + (t1.tv_nsec - t0.tv_nsec) / 1e6;
+    printf("[Publicador] Vista previa %dx%d guardada en %s (%.2f ms)\n",
+           preview->header.width_px, height, pathPreview, ms);
+}
+
+int main(int argc, char* argv[]) {
+    // Vista previa opcional: factor de reducción (p. ej. 4 u 8) y ruta de salida
+    int previewFactor = 0;
+    char* pathPreview = (argc >= 3) ? argv[2] : "salida/preview.bmp";
+    if (argc >= 2) {
+        char* end;
+        errno = 0;
+        long factor = strtol(argv[1], &end, 10);
+        int maxFactor = (MAX_WIDTH > MAX_HEIGHT) ? MAX_WIDTH : MAX_HEIGHT;
+        if (errno != 0 || end == argv[1] || *end != '\0' || factor < 2 || factor > maxFactor) {
+            printError(ARGUMENT_ERROR);
+            printf("Uso: %s [factor_vista_previa (2-%d) [ruta_vista_previa]]\n", argv[0], maxFactor);
+            return EXIT_FAILURE;
+        }
+        previewFactor = (int)factor;
+    }
+
     printf("[Publicador] Iniciando.\n");
 
     SharedData* shared = map_shared_memory();
     if (!shared) return EXIT_FAILURE;
 
+    // Copia privada para la vista previa, así no compite con los filtros sobre la memoria compartida
+    SharedData* preview = NULL;
+    if (previewFactor) {
+        preview = malloc(sizeof(SharedData));
+        if (!preview) {
+            printError(MEMORY_ERROR);
+            munmap(shared, sizeof(SharedData));
+            return EXIT_FAILURE;
+        }
+        printf("[Publicador] Vista previa activada (factor 1/%d).\n", previewFactor);
+    }
+
     // Crear semáforos
     sem_t* sem_desenfocar_ready = sem_open(SEM_DESENFOCAR_READY, O_CREAT, 0666, 0);
     sem_t* sem_realzar_ready    = sem_open(SEM_REALZAR_READY,  O_CREAT, 0666, 0);
@@ -68,6 +116,7 @@ int main() {
 
     if (sem_desenfocar_ready == SEM_FAILED || sem_realzar_ready    == SEM_FAILED || sem_desenfocar_done  == SEM_FAILED || sem_realzar_done     == SEM_FAILED) {
         printError(FILE_ERROR);
+        free(preview);
         munmap(shared, sizeof(SharedData));
         return EXIT_FAILURE;
     }
@@ -101,10 +150,21 @@ int main() {
         fclose(f);
         printf("[Publicador] Imagen cargada.\n");
 
+        // Reducir antes de liberar a los filtros, que modifican la imagen compartida en sitio
+        // Esta reducción queda en el camino crítico: retrasa el inicio de los filtros a resolución completa
+        struct timespec previewStart;
+        clock_gettime(CLOCK_MONOTONIC, &previewStart);
+        int previewReady = preview && downsampleImage(shared, preview, previewFactor) == 0;
 
         sem_post(sem_desenfocar_ready);
         sem_post(sem_realzar_ready);
 
+        // La vista previa se procesa mientras el Desenfocador y el Realzador trabajan la resolución completa
+        if (previewReady) {
+            printf("[Publicador] Generando vista previa...\n");
+            write_preview(preview, pathPreview, previewStart);
+        }
+
         // Esperar a que cada uno termine con timeout
         printf("[Publicador] Esperando desenfocador...\n");
         int desenfocado = wait_with_timeout(sem_desenfocar_done, "Desenfocador", 60);
@@ -147,6 +207,7 @@ int main() {
     sem_unlink(SEM_REALZAR_READY);
     sem_unlink(SEM_DESENFOCAR_DONE);
     sem_unlink(SEM_REALZAR_DONE);
+    free(preview);
     munmap(shared, sizeof(SharedData));
     shm_unlink(SHM_NAME);
     
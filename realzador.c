@@ -1,5 +1,6 @@
 #include "common.h"
 #include "bmp.h"
+#include "filtros.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -16,36 +17,6 @@ typedef struct {
     int endY;
 } RealceTask;
 
-// Función que realza bordes con los límites (startY y endY) establecidos, desde la mitad de la imagen hacia abajo
-static void realce_chunk(SharedData* shared, int startY, int endY) {
-    int width  = shared->header.width_px;
-    for (int y = startY; y < endY - 1; y++) {
-        for (int x = 1; x < width - 1; x++) {
-            int sumB=0, sumG=0, sumR=0;
-            for (int dy=-1; dy<=1; dy++) {
-                for (int dx=-1; dx<=1; dx++) {
-                    if (!(dy==0 && dx==0)) {
-                        sumB += shared->pixels[y+dy][x+dx].blue;
-                        sumG += shared->pixels[y+dy][x+dx].green;
-                        sumR += shared->pixels[y+dy][x+dx].red;
-                    }
-                }
-            }
-            int avgB = sumB / 8;
-            int avgG = sumG / 8;
-            int avgR = sumR / 8;
-
-            int eB = 2 * shared->pixels[y][x].blue  - avgB;
-            int eG = 2 * shared->pixels[y][x].green - avgG;
-            int eR = 2 * shared->pixels[y][x].red   - avgR;
-
-            shared->pixels[y][x].blue  = (eB>255)?255:((eB<0)?0:eB);
-            shared->pixels[y][x].green = (eG>255)?255:((eG<0)?0:eG);
-            shared->pixels[y][x].red   = (eR>255)?255:((eR<0)?0:eR);
-        }
-    }
-}
-
 // Función que ejecutarán los hilos
 static void* realce_thread(void* arg) {
     RealceTask* task = (RealceTask*)arg;